@@ -6,6 +6,9 @@
 extern "C" {
 #endif
 
+extern int molfile_cdcdplugin_init(void);
+extern int molfile_cdcdplugin_register(void *, vmdplugin_register_cb);
+extern int molfile_cdcdplugin_fini(void);
 extern int molfile_dcdplugin_init(void);
 extern int molfile_dcdplugin_register(void *, vmdplugin_register_cb);
 extern int molfile_dcdplugin_fini(void);
@@ -23,6 +26,7 @@ extern int molfile_namdbinplugin_register(void *, vmdplugin_register_cb);
 extern int molfile_namdbinplugin_fini(void);
 
 #define MOLFILE_INIT_ALL \
+    molfile_cdcdplugin_init(); \
     molfile_dcdplugin_init(); \
     molfile_jsplugin_init(); \
     molfile_pdbplugin_init(); \
@@ -30,6 +34,7 @@ extern int molfile_namdbinplugin_fini(void);
     molfile_namdbinplugin_init(); \
 
 #define MOLFILE_REGISTER_ALL(v, cb) \
+    molfile_cdcdplugin_register(v, cb); \
     molfile_dcdplugin_register(v, cb); \
     molfile_jsplugin_register(v, cb); \
     molfile_pdbplugin_register(v, cb); \
@@ -37,6 +42,7 @@ extern int molfile_namdbinplugin_fini(void);
     molfile_namdbinplugin_register(v, cb); \
 
 #define MOLFILE_FINI_ALL \
+    molfile_cdcdplugin_fini(); \
     molfile_dcdplugin_fini(); \
     molfile_jsplugin_fini(); \
     molfile_pdbplugin_fini(); \
@@ -0,0 +1,277 @@
+/***************************************************************************
+ *cr
+ *cr            (C) Copyright 1995-2016 The Board of Trustees of the
+ *cr                        University of Illinois
+ *cr                         All Rights Reserved
+ *cr
+ ***************************************************************************/
+
+/***************************************************************************
+ * Reader for NAMD compressed trajectory (.cdcd) files as written by
+ * write_cdcdstep() in dcdlib.C.  The header is the characters NAMDCDCD
+ * followed by int32 version, natoms, first step, steps per frame,
+ * double timestep and float precision.  Each frame is int32 step,
+ * int32 with_unitcell, six DCD unit cell doubles if present, int32 nbytes
+ * and the packed coordinates.  Packed coordinates are zigzag-encoded
+ * differences from the previous atom of the integers round(x*precision),
+ * in blocks of CDCD_BLOCK atoms each led by a byte giving the bit width.
+ ***************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+#include "molfile_plugin.h"
+
+#ifndef M_PI_2
+#define M_PI_2 1.57079632679489661922
+#endif
+
+#if INT_MAX == 2147483647
+  typedef int cdcd_int32;
+#elif SHRT_MAX == 2147483647
+  typedef short cdcd_int32;
+#elif LONG_MAX == 2147483647
+  typedef long cdcd_int32;
+#endif
+
+#define CDCD_VERSION 1
+#define CDCD_BLOCK 8
+
+typedef struct {
+  FILE *fd;
+  int numatoms;
+  int wrongendian;
+  float precision;
+  unsigned char *buf;
+  int bufsize;
+} cdcdhandle;
+
+static void swap4(void *v) {
+  char *c = (char *) v;
+  char tmp;
+  tmp = c[0]; c[0] = c[3]; c[3] = tmp;
+  tmp = c[1]; c[1] = c[2]; c[2] = tmp;
+}
+
+static void swap8(void *v) {
+  char *c = (char *) v;
+  char tmp;
+  int i;
+  for ( i=0; i<4; ++i ) {
+    tmp = c[i]; c[i] = c[7-i]; c[7-i] = tmp;
+  }
+}
+
+static int read_int32(cdcdhandle *cdcd, int *val) {
+  cdcd_int32 tmp;
+  if ( fread(&tmp, sizeof(cdcd_int32), 1, cdcd->fd) != 1 ) return -1;
+  if ( cdcd->wrongendian ) swap4(&tmp);
+  *val = tmp;
+  return 0;
+}
+
+static void *open_cdcd_read(const char *path, const char *filetype,
+    int *natoms) {
+  cdcdhandle *cdcd;
+  FILE *fd;
+  char magic[8];
+  cdcd_int32 version;
+  int numatoms, istart, nsavc;
+  double delta;
+
+  cdcd = (cdcdhandle *)malloc(sizeof(cdcdhandle));
+  if (!cdcd) {
+    fprintf(stderr, "Unable to allocate space for read buffer.\n");
+    return NULL;
+  }
+  memset(cdcd, 0, sizeof(cdcdhandle));
+
+  fd = fopen(path, "rb");
+  if (!fd) {
+    fprintf(stderr, "Could not open file '%s' for reading.\n", path);
+    free(cdcd);
+    return NULL;
+  }
+  cdcd->fd = fd;
+
+  if ( fread(magic, 1, 8, fd) != 8 || strncmp(magic, "NAMDCDCD", 8) ||
+       fread(&version, sizeof(cdcd_int32), 1, fd) != 1 ) {
+    fprintf(stderr, "File '%s' is not a NAMD compressed trajectory.\n", path);
+    fclose(fd);
+    free(cdcd);
+    return NULL;
+  }
+  if ( version != CDCD_VERSION ) {
+    swap4(&version);
+    cdcd->wrongendian = 1;
+  }
+  if ( version != CDCD_VERSION ) {
+    fprintf(stderr, "Unsupported version in file '%s'.\n", path);
+    fclose(fd);
+    free(cdcd);
+    return NULL;
+  }
+  if ( cdcd->wrongendian ) {
+    fprintf(stderr, "File '%s' appears to be other-endian.\n", path);
+  }
+
+  if ( read_int32(cdcd, &numatoms) || read_int32(cdcd, &istart) ||
+       read_int32(cdcd, &nsavc) ||
+       fread(&delta, sizeof(double), 1, fd) != 1 ||
+       fread(&cdcd->precision, sizeof(float), 1, fd) != 1 ) {
+    fprintf(stderr, "File '%s' is too short.\n", path);
+    fclose(fd);
+    free(cdcd);
+    return NULL;
+  }
+  if ( cdcd->wrongendian ) swap4(&cdcd->precision);
+  if ( numatoms < 1 || ! ( cdcd->precision > 0 ) ) {
+    fprintf(stderr, "Invalid header in file '%s'.\n", path);
+    fclose(fd);
+    free(cdcd);
+    return NULL;
+  }
+
+  cdcd->numatoms = numatoms;
+  cdcd->bufsize = 12 * numatoms + ( numatoms + CDCD_BLOCK - 1 ) / CDCD_BLOCK;
+  cdcd->buf = (unsigned char *)malloc(cdcd->bufsize);
+  if ( ! cdcd->buf ) {
+    fprintf(stderr, "Unable to allocate space for read buffer.\n");
+    fclose(fd);
+    free(cdcd);
+    return NULL;
+  }
+  *natoms = numatoms;
+  return cdcd;
+}
+
+static int unpack_coords(cdcdhandle *cdcd, int nbytes, float *coords) {
+  const unsigned char *in = cdcd->buf;
+  const unsigned char *end = cdcd->buf + nbytes;
+  const float scale = 1.0f / cdcd->precision;
+  cdcd_int32 last[3] = { 0, 0, 0 };
+  int i, j;
+
+  for ( i=0; i<cdcd->numatoms; i+=CDCD_BLOCK ) {
+    unsigned long long acc = 0;
+    unsigned long long mask;
+    int nacc = 0;
+    int bits, n;
+    n = cdcd->numatoms - i;
+    if ( n > CDCD_BLOCK ) n = CDCD_BLOCK;
+    if ( in >= end ) return -1;
+    bits = *(in++);
+    if ( bits > 32 ) return -1;
+    mask = ( 1ULL << bits ) - 1;
+    for ( j=0; j<3*n; ++j ) {
+      unsigned int z;
+      cdcd_int32 d;
+      while ( nacc < bits ) {
+        if ( in >= end ) return -1;
+        acc |= ( (unsigned long long) *(in++) ) << nacc;
+        nacc += 8;
+      }
+      z = (unsigned int) ( acc & mask );
+      acc >>= bits;
+      nacc -= bits;
+      d = ( z & 1u ) ? - (cdcd_int32) ( z >> 1 ) - 1 : (cdcd_int32) ( z >> 1 );
+      last[j%3] += d;
+      if ( coords ) coords[3L*i+j] = last[j%3] * scale;
+    }
+  }
+  return 0;
+}
+
+static int read_next_timestep(void *v, int natoms, molfile_timestep_t *ts) {
+  cdcdhandle *cdcd;
+  int step, with_unitcell, nbytes, i;
+  double unitcell[6];
+
+  cdcd = (cdcdhandle *)v;
+  if ( read_int32(cdcd, &step) )
+    return MOLFILE_ERROR;  /* Done reading frames */
+
+  if ( read_int32(cdcd, &with_unitcell) ) {
+    fprintf(stderr, "Failure reading data from NAMD compressed trajectory.\n");
+    return MOLFILE_ERROR;
+  }
+  unitcell[0] = unitcell[2] = unitcell[5] = 0.0;
+  unitcell[1] = unitcell[3] = unitcell[4] = 0.0;
+  if ( with_unitcell ) {
+    if ( fread(unitcell, sizeof(double), 6, cdcd->fd) != 6 ) {
+      fprintf(stderr, "Failure reading data from NAMD compressed trajectory.\n");
+      return MOLFILE_ERROR;
+    }
+    if ( cdcd->wrongendian ) {
+      for ( i=0; i<6; ++i ) swap8(unitcell + i);
+    }
+  }
+
+  if ( read_int32(cdcd, &nbytes) || nbytes < 0 || nbytes > cdcd->bufsize ||
+       fread(cdcd->buf, 1, nbytes, cdcd->fd) != (size_t) nbytes ) {
+    fprintf(stderr, "Failure reading data from NAMD compressed trajectory.\n");
+    return MOLFILE_ERROR;
+  }
+
+  /* skip frames without unpacking when ts is NULL */
+  if ( ! ts ) return MOLFILE_SUCCESS;
+
+  if ( unpack_coords(cdcd, nbytes, ts->coords) ) {
+    fprintf(stderr, "Corrupt frame in NAMD compressed trajectory.\n");
+    return MOLFILE_ERROR;
+  }
+
+  ts->A = unitcell[0];
+  ts->B = unitcell[2];
+  ts->C = unitcell[5];
+  /* NAMD writes the cosines of the cell angles, see dcdplugin.c */
+  ts->alpha = 90.0 - asin(unitcell[4]) * 90.0 / M_PI_2; /* cosBC */
+  ts->beta  = 90.0 - asin(unitcell[3]) * 90.0 / M_PI_2; /* cosAC */
+  ts->gamma = 90.0 - asin(unitcell[1]) * 90.0 / M_PI_2; /* cosAB */
+
+  return MOLFILE_SUCCESS;
+}
+
+static void close_file_read(void *v) {
+  cdcdhandle *cdcd = (cdcdhandle *)v;
+  if (cdcd->fd)
+    fclose(cdcd->fd);
+  free(cdcd->buf);
+  free(cdcd);
+}
+
+/*
+ * Initialization stuff here
+ */
+
+static molfile_plugin_t plugin;
+
+VMDPLUGIN_API int VMDPLUGIN_init() {
+  memset(&plugin, 0, sizeof(molfile_plugin_t));
+  plugin.abiversion = vmdplugin_ABIVERSION;
+  plugin.type = MOLFILE_PLUGIN_TYPE;
+  plugin.name = "cdcd";
+  plugin.prettyname = "NAMD Compressed Trajectory";
+  plugin.author = "NAMD developers";
+  plugin.majorv = 0;
+  plugin.minorv = 1;
+  plugin.is_reentrant = VMDPLUGIN_THREADSAFE;
+  plugin.filename_extension = "cdcd";
+  plugin.open_file_read = open_cdcd_read;
+  plugin.read_next_timestep = read_next_timestep;
+  plugin.close_file_read = close_file_read;
+  return VMDPLUGIN_SUCCESS;
+}
+
+VMDPLUGIN_API int VMDPLUGIN_register(void *v, vmdplugin_register_cb cb) {
+  (*cb)(v, (vmdplugin_t *)&plugin);
+  return VMDPLUGIN_SUCCESS;
+}
+
+VMDPLUGIN_API int VMDPLUGIN_fini() {
+  return VMDPLUGIN_SUCCESS;
+}
+
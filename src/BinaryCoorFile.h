@@ -0,0 +1,81 @@
+/**
+***  Copyright (c) 1995, 1996, 1997, 1998, 1999, 2000 by
+***  The Board of Trustees of the University of Illinois.
+***  All rights reserved.
+**/
+
+#ifndef BINARYCOORFILE_H
+#define BINARYCOORFILE_H
+
+#include <stdio.h>
+#include "common.h"
+#include "Vector.h"
+
+#if ! defined(WIN32) || defined(__CYGWIN__)
+#define NAMD_MMAP_BINARY_FILES 1
+#endif
+
+// FileRangeMap
+// Maps bytes [offset, offset+length) of an open file read-only.  map()
+// returns 0 if mmap is unavailable, fails, or the range extends past the
+// end of the file, in which case callers fall back to reading the file.
+
+class FileRangeMap {
+
+public:
+  FileRangeMap() : base(0), len(0), start(0) { }
+  ~FileRangeMap() { unmap(); }
+
+  const char *map(FILE *fp, int64 offset, size_t length);
+  void unmap();
+  const char *data() const { return start; }
+
+  // hints that the range will be needed soon or read in order
+  void willNeed();
+  void sequential();
+
+private:
+  char *base;   // page-aligned start of the mapping
+  size_t len;
+  const char *start;
+};
+
+// BinaryCoorFile
+// Reads binary coordinate and velocity files (an int32 atom count
+// followed by 3*n doubles).  A range of atoms is mapped into memory and
+// copied straight into its destination, byte swapping on the way for
+// other-endian files, so no intermediate buffer is needed.  Only the
+// pages covering the requested range are mapped, so each input proc
+// touches just its own part of the file.  Falls back to buffered reads
+// where mmap is unavailable or fails.
+
+class BinaryCoorFile {
+
+public:
+  // opens fname and checks its atom count against n; dies on error
+  BinaryCoorFile(const char *fname, int n);
+  ~BinaryCoorFile();
+
+  // maps atoms [first, first+count) and asks the OS to read them ahead
+  void prefetch(int first, int count);
+
+  // copies atoms [first, first+count) to dest, spaced stride bytes apart
+  void read(int first, int count, Vector *dest, size_t stride=sizeof(Vector));
+
+  int flipped() const { return needFlip; }
+
+private:
+  void map(int first, int count);
+  void readBuffered(int first, int count, char *dest, size_t stride);
+
+  char fname[256];
+  FILE *fp;
+  int numAtoms;
+  int needFlip;
+  FileRangeMap mapping;
+  int mapFirst;
+  int mapCount;
+};
+
+#endif
+
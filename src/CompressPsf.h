@@ -12,6 +12,23 @@
 //the per-atom binary file
 #define COMPRESSED_PSF_MAGICNUM 1234
 
+//leading characters of the binary form of the compressed psf file,
+//which is written instead of the text form when binaryCompressedPsf is set
+#define COMPRESSED_PSF_BINARY_MAGIC "NAMDBPSF"
+#define COMPRESSED_PSF_BINARY_MAGICLEN 8
+//fixed width of each entry of the name pools in the binary form
+#define COMPRESSED_PSF_NAMELEN 16
+
+//the counts stored in the header of the binary form, in order
+enum CompressedPsfCount {
+  CPSF_NSEGMENTNAMES, CPSF_NRESIDUENAMES, CPSF_NATOMNAMES, CPSF_NATOMTYPES,
+  CPSF_NCHARGES, CPSF_NMASSES, CPSF_NATOMSIGS, CPSF_NEXCLSIGS,
+  CPSF_NCLUSTERS, CPSF_NATOM, CPSF_NHYDROGENGROUP, CPSF_MAXHYDROGENGROUPSIZE,
+  CPSF_NMIGRATIONGROUP, CPSF_MAXMIGRATIONGROUPSIZE, CPSF_RIGIDBONDTYPE,
+  CPSF_NDIHEDRALPARAMS, CPSF_NIMPROPERPARAMS,
+  CPSF_NUMCOUNTS
+};
+
 class Molecule;
 class Parameters;
 class SimParameters;
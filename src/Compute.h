@@ -38,6 +38,7 @@ protected:
   void enqueueWork();
   int gbisPhase;//earlier phases have higher priority
   int gbisPhasePriority[3];//earlier phases have higher priority
+  int isProxyPriority(PatchID pid);//results sent to other PEs are urgent
 
 public:
   const ComputeID cid;
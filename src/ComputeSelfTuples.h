@@ -283,8 +283,7 @@ template <class T, class S, class P> class ComputeSelfTuples :
 
       this->doLoadTuples = true;
 
-      int myNode = CkMyPe();
-      if ( PatchMap::Object()->node(patchID) != myNode )
+      if ( this->isProxyPriority(patchID) )
       {
         this->basePriority = COMPUTE_PROXY_PRIORITY + PATCH_PRIORITY(patchID);
       }
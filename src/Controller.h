@@ -171,9 +171,15 @@ protected:
       int rescaleVelocities_numTemps;
     void reassignVelocities(int);
     void tcoupleVelocities(int);
+      int tcoupleVelocities_lastStep;  // for controllerBarrier no
     void berendsenPressure(int);
+    Tensor berendsenPressureFactor(int, const Tensor &);
       // Tensor berendsenPressure_avg;
       // int berendsenPressure_count;
+      int berendsenPressure_samples;  // for controllerBarrier no
+      int berendsenPressure_pending;  // for controllerBarrier no
+      Tensor berendsenPressure_factor;  // for controllerBarrier no
+      Tensor berendsenPressure_lastAvg;  // for controllerBarrier no
     void langevinPiston1(int);
     void langevinPiston2(int);
       Tensor langevinPiston_origStrainRate;
@@ -196,6 +202,7 @@ protected:
     void rebalanceLoad(int);
       int fflush_count;
     void cycleBarrier(int,int);	
+    void collectPerfCounters(int);
 	
 	void traceBarrier(int, int);
 
@@ -0,0 +1,28 @@
+/** \file DiffusionLB.h
+ *  Incremental load balancer.  Each overloaded processor hands at most a
+ *  few computes to neighboring processors, those that already hold the
+ *  compute's patches or share its node, so that each balancing step
+ *  moves little and can be run frequently to follow drifting load.
+ */
+
+#ifndef _DIFFUSIONLB_H_
+#define _DIFFUSIONLB_H_
+
+#include "Rebalancer.h"
+
+class DiffusionLB : public Rebalancer
+{
+  private:
+    int maxMoves;
+
+    void strategy();
+    processorInfo *selectPe(processorInfo *p, computeInfo *c,
+                            double threshold);
+
+  public:
+    DiffusionLB(computeInfo *cs, patchInfo *pas, processorInfo *pes, int ncs,
+                int npas, int npes, int maxMovesPerPe);
+    ~DiffusionLB();
+};
+
+#endif
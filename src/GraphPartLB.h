@@ -0,0 +1,59 @@
+/** \file GraphPartLB.h
+ *  Communication-aware load balancer.  Computes are the vertices of a
+ *  graph, connected through the patches they read, and every proxy a
+ *  compute needs away from its home patch costs the bytes of the proxy
+ *  messages for that patch.  The graph is coarsened by merging computes
+ *  that share the most proxy traffic, the coarsest graph is placed
+ *  greedily, and the placement is refined while uncoarsening to reduce
+ *  proxy traffic within the load tolerance.  Processor background loads
+ *  (scaled by ldbBackgroundScaling and friends) and unavailable
+ *  processors such as unloaded PME processors are respected throughout,
+ *  and the result is finished by the RefineTorusLB refinement.
+ */
+
+#ifndef _GRAPHPARTLB_H_
+#define _GRAPHPARTLB_H_
+
+#include <vector>
+#include <map>
+#include <set>
+#include "Rebalancer.h"
+#include "RefineTorusLB.h"
+
+class GraphPartLB : public RefineTorusLB
+{
+  private:
+    struct Vertex {
+      double load;
+      int pe;  // index into processors, -1 if unplaced
+      std::vector<int> patches;  // sorted
+    };
+    typedef std::vector<Vertex> Graph;
+
+    std::vector<Graph> levels;  // levels[0] holds one vertex per compute
+    std::vector< std::vector<int> > parent;  // vertex in the next level
+    std::vector< std::map<int,int> > users;  // patch -> pe -> count
+    std::vector<double> peLoad;
+    std::set< std::pair<double,int> > peByLoad;  // available pes
+    double maxLoad;
+
+    void strategy(int refineOnly);
+    void coarsen();
+    void initialPartition();
+    void refineLevel(int level);
+    void resetPlacement(Graph &g);
+    void place(Vertex &v, int pe);
+    void unplace(Vertex &v);
+    double proxyCost(int patch, int pe);
+    double addCost(const Vertex &v, int pe);
+    double removeGain(const Vertex &v);
+    double totalCost(Graph &g);
+
+  public:
+    // with refineOnly the current mapping is improved rather than replaced
+    GraphPartLB(computeInfo *cs, patchInfo *pas, processorInfo *pes, int ncs,
+                int npas, int npes, int refineOnly);
+    ~GraphPartLB();
+};
+
+#endif
@@ -176,13 +176,30 @@ public:
   void recvCheckpointStore(CheckpointAtomsMsg *msg);
   void recvCheckpointAck();
   int checkpoint_task;
+  // Checkpoints are stored as the atoms that differ from a full atom list
+  // shared with earlier checkpoints, which is replaced when more than half
+  // of the atoms have changed.
+  struct checkpoint_atoms_t {
+    int refCount;
+    ResizeArray<FullAtom> atoms;
+  };
   struct checkpoint_t {
     Lattice lattice;
     int berendsenPressure_count;
     int numAtoms;
-    ResizeArray<FullAtom> atoms;
+    checkpoint_atoms_t *base;
+    ResizeArray<int> changed;  // indices of atoms that differ from base
+    ResizeArray<FullAtom> atoms;  // and their values
+    checkpoint_t() : base(0) { }
   };
   std::map<std::string,checkpoint_t*> checkpoints;
+  checkpoint_atoms_t *checkpoint_base;  // base for the next checkpoint
+  void storeCheckpoint(const char *key, const Lattice &lat, int bpc,
+                        int n, const FullAtom *a);
+  void loadCheckpoint(const checkpoint_t &cp, FullAtom *a);
+  void freeCheckpoint(const char *key);
+  void releaseCheckpointAtoms(checkpoint_atoms_t *ca);
+  void localCheckpoint(int task, const char *key, int &bpc);
 
   // replica exchange
   void exchangeAtoms(int scriptTask);
@@ -353,6 +370,7 @@ private:
 #if CMK_PERSISTENT_COMM
   PersistentHandle *localphs;
   int nphs;
+  int persistSize;
 #endif
 };
 
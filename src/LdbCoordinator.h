@@ -132,6 +132,7 @@ public:
   LDBarrierClient ldBarrierHandle;
   int reg_all_objs;
   LDObjHandle* patchHandles;
+  int numMigrations;  // set by the central strategy on pe 0, -1 if unknown
 
   void sendCollectLoads(CollectLoadsMsg*);
   void collectLoads(CollectLoadsMsg*);
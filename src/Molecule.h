@@ -329,6 +329,7 @@ private:
   Real *langevinParams;   //  b values for langevin dynamics
   int32 *fixedAtomFlags;  //  1 for fixed, -1 for fixed group, else 0
   int32 *exPressureAtomFlags; // 1 for excluded, -1 for excluded group.
+  int32 *dcdSelectionFlags; // 1 if written to coordinate trajectories
 
   //In the memory optimized version: it will be NULL if the general
   //true assumption mentioned above holds. If not, its size is numClusters.
@@ -437,6 +438,7 @@ private:
   //the method to load the signatures of atoms etc. (i.e. reading the file in 
   //text fomrat of the compressed psf file)
   void read_mol_signatures(char *fname, Parameters *params, ConfigList *cfgList=0);	
+  void read_mol_signatures_binary(FILE *fp, char *fname, Parameters *params, ConfigList *cfgList);
   void load_one_inputatom(int aid, OutputAtomRecord *one, InputAtom *fAtom);
   void build_excl_check_signatures();  
 #endif
@@ -576,6 +578,7 @@ public:
   int numFixedAtoms;  //  Number of fixed atoms
   int numStirredAtoms;  //  Number of stirred atoms
   int numExPressureAtoms; //  Number of atoms excluded from pressure
+  int numDcdSelectionAtoms; //  Atoms in trajectories, 0 if all
   int numHydrogenGroups;  //  Number of hydrogen groups
   int maxHydrogenGroupSize;  //  Max atoms per hydrogen group
   int numMigrationGroups;  //  Number of migration groups
@@ -880,6 +883,14 @@ public:
   void build_langevin_params(StringList *, StringList *, PDB *, char *);
         //  Build the set of langevin dynamics parameters
 
+#ifndef MEM_OPT_VERSION
+  void repartition_hydrogen_masses(void);
+        //  Move mass from heavy atoms to bonded hydrogens
+
+  BigReal stable_timestep(int mtsSteps);
+        //  Estimate largest stable timestep in fs, 0 if no limit
+#endif
+
 #ifdef MEM_OPT_VERSION
   void load_fixed_atoms(StringList *fixedFile);
   void load_constrained_atoms(StringList *constrainedFile);
@@ -903,6 +914,10 @@ public:
         //  Determine which atoms are excluded from
                                 //  pressure (if any)
 
+  void build_dcd_selection(StringList *, StringList *, PDB *, char *);
+        //  Determine which atoms are written to
+                                //  coordinate trajectories
+
   // Ported by JLai -- Original JE - Go -- Change the unsigned int to ints
   void print_go_sigmas(); //  Print out Go sigma parameters
   void build_go_sigmas(StringList *, char *);
@@ -1367,6 +1382,10 @@ public:
   {
     return (numExPressureAtoms && exPressureAtomFlags[atomnum]);
   }
+  Bool is_atom_dcd_selected(int atomnum) const
+  {
+    return (! numDcdSelectionAtoms || dcdSelectionFlags[atomnum]);
+  }
   // 0 if not rigid or length to parent, for parent refers to H-H length
   // < 0 implies MOLLY but not SHAKE, > 1 implies both if MOLLY is on
   Real rigid_bond_length(int atomnum) const
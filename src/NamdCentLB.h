@@ -45,6 +45,8 @@
 #include "InfoStream.h"
 #include "TorusLB.h"
 #include "RefineTorusLB.h"
+#include "GraphPartLB.h"
+#include "DiffusionLB.h"
 
 void CreateNamdCentLB();
 NamdCentLB *AllocateNamdCentLB();
@@ -64,7 +66,7 @@ private:
 #if USE_TOPOMAP 
   int requiredProxiesOnProcGrid(PatchID id, int neighborNodes[]);
 #endif
-  void dumpDataASCII(char *file, int numProcessors, int numPatches,
+  void dumpDataASCII(const char *file, int numProcessors, int numPatches,
 		int numComputes);
   void loadDataASCII(char *file, int &numProcessors, int &numPatches,
 		int &numComputes);
@@ -22,6 +22,8 @@
 #include "NamdDummyLB.h"
 #include "TorusLB.h"
 #include "RefineTorusLB.h"
+#include "GraphPartLB.h"
+#include "DiffusionLB.h"
 
 void CreateNamdHybridLB();
 
@@ -92,7 +94,7 @@ private:
   
   int buildData(LDStats* stats);
   int requiredProxies(PatchID id, int neighborNodes[]);
-  void dumpDataASCII(char *file, int numProcessors, int numPatches,
+  void dumpDataASCII(const char *file, int numProcessors, int numPatches,
                 int numComputes);
 
   // centralized load balancer for load balancing all the children processors
@@ -56,6 +56,9 @@ class CheckpointMsg;
 class Lattice;
 class ControllerState;
 
+// number of phases in Node::startup()
+#define NAMD_STARTUP_PHASES 13
+
 #ifdef MEM_OPT_VERSION
 class ParallelIOMgr;
 #endif
@@ -160,6 +163,13 @@ public:
   
   void outputPatchComputeMaps(const char *filename, int tag);
 
+  //entry method collecting startup phase timing and memory on PE 0
+  void recvStartupProfile(CkReductionMsg *msg);
+
+  //entry methods for per-step performance counters
+  void collectPerfCounters(int step);
+  void recvPerfCounters(CkReductionMsg *msg);
+
   //to show whether +traceoff is specified
   bool specialTracing;
   
@@ -219,6 +229,20 @@ private:
 
   // Startup phase
   int startupPhase;
+
+  // Startup profile: time spent in startup() and highest sampled memory
+  // use for each phase on this PE, reduced to PE 0 once startup finishes
+  void sampleStartupMemory(int phase);
+  void contributeStartupProfile();
+  void writeStartupProfile();
+  double startupBusy[NAMD_STARTUP_PHASES];
+  double startupPeakMemory[NAMD_STARTUP_PHASES];  // MB
+  double startupWall[NAMD_STARTUP_PHASES];  // PE 0 only
+  double *startupProfileMax;  // PE 0 only, until both reductions arrive
+  double *startupProfileSum;
+
+  CkReductionMsg *perfCountersSum;  // PE 0 only, until both reductions arrive
+  CkReductionMsg *perfCountersMax;
   int localRankOnNode;
 #ifdef CMK_BALANCED_INJECTION_API
   int balancedInjectionLevel;
@@ -20,6 +20,7 @@ class FloatVector;
 class Lattice;
 class ReplicaDcdInitMsg;
 class ReplicaDcdDataMsg;
+class OutputWriter;
 
 // semaphore "steps", must be negative
 #define FILE_OUTPUT -1
@@ -50,6 +51,8 @@ friend class SimParameters;
    //  output coords to dcd file
    //  Pass non-NULL Lattice to include unit cell in the timesteps.
    int output_dcdfile(int, int, FloatVector *, const Lattice *); 
+   //  output coords to compressed trajectory file
+   void output_cdcdfile(int, int, FloatVector *, const Lattice *);
    void output_veldcdfile(int, int, Vector *); 	//  output velocities to
 						//  dcd file
    void output_forcedcdfile(int, int, Vector *); //  output forces to
@@ -66,9 +69,12 @@ friend class SimParameters;
    void output_forces(int, int, Vector *);	//  output forces
 
    void scale_vels(Vector *, int, Real);	//  scale velocity vectors before output
-   void write_binary_file(char *, int, Vector *); // Write a binary restart file with
+   void write_binary_file(char *, int, Vector *, int async=0);
+						// Write a binary restart file with
 						//  coordinates or velocities
 
+   OutputWriter *writer;			//  background writer, if enabled
+
    struct replicaDcdFile {
      std::string filename;
      int fileid;
@@ -136,6 +142,7 @@ private:
     int dcdFileID;
     Bool dcdFirst;
     float *dcdX, *dcdY, *dcdZ;
+    int64 dcdFrames; //frames handed to aggregators
 
     int veldcdFileID;
     Bool veldcdFirst;    
@@ -152,6 +159,7 @@ public:
         dcdFileID=veldcdFileID=-99999;
         forcedcdFileID=-99999;
         dcdFirst=veldcdFirst=TRUE;
+        dcdFrames=0;
         forcedcdFirst=TRUE;
         dcdX=dcdY=dcdZ=veldcdX=veldcdY=veldcdZ=NULL;
         forcedcdX=forcedcdY=forcedcdZ=NULL;
@@ -0,0 +1,88 @@
+/**
+***  Copyright (c) 1995, 1996, 1997, 1998, 1999, 2000 by
+***  The Board of Trustees of the University of Illinois.
+***  All rights reserved.
+**/
+
+#ifndef OUTPUTWRITER_H
+#define OUTPUTWRITER_H
+
+#include "common.h"
+
+#if ! ( defined(WIN32) && ! defined(__CYGWIN__) )
+#define NAMD_ASYNC_OUTPUT 1
+#include <pthread.h>
+#endif
+
+// OutputWriter
+// Performs trajectory and restart file writes for Output on a background
+// thread so that they overlap with the following timesteps.  Files are
+// opened and headers written by the caller, so configuration errors are
+// still reported synchronously; only the bulk writes are queued.  Every
+// request copies its data into one of OUTPUTWRITER_BUFFERS recycled
+// buffers, and a request blocks while all buffers are in flight.
+// Requests on the same file complete in the order they were made.
+// The worker thread runs outside Charm++, so it records the first write
+// error and the master reports it with NAMD_err on its next request, on
+// flush(), or on destruction.
+
+#define OUTPUTWRITER_BUFFERS 2
+
+class OutputWriter {
+
+public:
+  OutputWriter(int async);
+  ~OutputWriter();
+
+  // write one DCD frame to an open DCD file, updating its header
+  void dcdStep(int fd, int n, const float *x, const float *y,
+                const float *z, const double *unitcell);
+
+  // reserve() returns a buffer of at least maxlen bytes to be filled
+  // in before commit() appends the first len bytes to an open file,
+  // closing it afterwards if fname is given
+  char *reserve(size_t maxlen);
+  void commit(int fd, size_t len, const char *fname=0);
+
+  // wait until all queued writes have completed
+  void flush();
+
+private:
+  struct Request {
+    int type;
+    int fd;
+    int n;
+    int with_unitcell;
+    double unitcell[6];
+    char *buf;
+    size_t len;
+    size_t alloc;
+    char fname[256];
+  };
+
+  void perform(Request *r);
+  Request *acquire(size_t len);
+  void submit(Request *r);
+  void setError(const char *msg, int err);
+  void checkError();
+
+  int async;
+  Request requests[OUTPUTWRITER_BUFFERS];
+  Request *pending;  // reserved but not yet committed
+  int head;          // index of oldest queued request
+  int count;         // number of queued requests
+  int errorNumber;   // errno of the first failed write
+  char errorMsg[320];  // message of the first failed write, if any
+#ifdef NAMD_ASYNC_OUTPUT
+  static void *threadMain(void *);
+  void run();
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  int running;
+  int stopping;
+#endif
+};
+
+#endif
+
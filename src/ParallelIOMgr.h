@@ -26,6 +26,7 @@ class CollectMidVectorInstance;
 
 class CollectVectorVarMsg;
 class PatchMap;
+class BinaryCoorFile;
 
 #include "ParallelIOMgr.decl.h"
 
@@ -147,6 +148,21 @@ public:
     Vector dsum;    
 };
 typedef ResizeArray<ClusterCoorMsg *> ClusterCoorMsgBuffer;
+
+//Pieces of one DCD frame sent from an output proc to the aggregator
+//that writes the file range [lo,hi). Segment offsets are relative to lo.
+class DcdSlabMsg : public CMessage_DcdSlabMsg
+{
+public:
+    int seq;
+    int numSegs;
+    int64 base; //file offset of the X record of this frame
+    int64 lo;
+    int64 hi;
+    int64 *segOffset;
+    int64 *segLength;
+    char *data;
+};
 ///////End of data struct declarations related to parallel output////////
 
 class ParallelIOMgr : public CBase_ParallelIOMgr
@@ -242,6 +258,15 @@ private:
     //the array is of size #local atoms on this output proc
     char *isWater;
 
+    //state of this proc as an aggregator of coordinate DCD frames
+    int dcdAggFileID;
+    int dcdAggSeq;
+    int dcdAggRemaining;
+    int64 dcdAggLo, dcdAggHi;
+    char *dcdAggBuf;
+    int64 dcdAggBufSize;
+    double dcdAggTime;
+
 #ifdef MEM_OPT_VERSION
     CollectMidVectorInstance *coorInstance;
     CollectionMidMaster *midCM;
@@ -256,7 +281,8 @@ private:
 #endif    
 
 private:
-    void readCoordinatesAndVelocity();
+    void readCoordinatesAndVelocity(BinaryCoorFile *coorFile,
+                    BinaryCoorFile *velFile, BinaryCoorFile *refFile);
     //create atom lists that are used for creating home patch
     void prepareHomePatchAtomList();
     //returns the index in hpIDList which points to pid
@@ -369,6 +395,14 @@ public:
     //free the space occupied by atoms' names etc.
     void freeMolSpace();
 
+    //two-phase output of coordinate DCD frames: output procs send their
+    //slices to numOutputWrts aggregators, each of which writes one
+    //stripe-aligned contiguous range of the frame
+    int numDcdAggregators(int step);
+    void sendDcdSlabs(int seq, int64 base, int fID, int tID, FloatVector *fvecs);
+    void recvDcdSlab(DcdSlabMsg *msg);
+    void closeDcdAggregator();
+
     //used in parallel IO output
     int getNumOutputProcs() { return numOutputProcs; }
     bool isOutputProcessor(int pe);
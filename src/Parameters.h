@@ -210,6 +210,7 @@ struct vdw_params;
 struct vdw_pair_params;
 struct nbthole_pair_params;
 struct table_pair_params;
+struct ParamLookupCache;
 
 class Parameters
 {
@@ -235,6 +236,8 @@ private:
 	struct vdw_pair_params *vdw_pairp;	//  Binary tree of vdw pairs
 	struct nbthole_pair_params *nbthole_pairp;      //  Binary tree of nbthole pairs
 	struct table_pair_params *table_pairp;	//  Binary tree of table pairs
+	struct ParamLookupCache *lookupCache;	//  Bonded lookups by type tuple
+	struct ParamLookupCache *lookup_cache();
 public:
 	BondValue *bond_array;			//  Array of bond params
 	AngleValue *angle_array;		//  Array of angle params
@@ -40,6 +40,13 @@ public:
 			int asplit, int bsplit, int csplit);
   void checkMap();
 
+  // Atom counts in nbins equal bins of the scaled coordinate of each
+  // periodic dimension, or null.  A dimension with large variations in
+  // density, such as a membrane with a vacuum slab, is then divided into
+  // slabs of similar atom count, no narrower than for a uniform grid,
+  // rather than into slabs of equal width.  Valid until makePatches().
+  void setAtomProfile(int nbins, const int *a, const int *b, const int *c);
+
   ~PatchMap(void);
 
   enum { MaxTwoAway = 5*5*5 - 3*3*3 };
@@ -74,6 +81,16 @@ public:
   inline int periodic_b(void) const { return bPeriodic; }
   inline int periodic_c(void) const { return cPeriodic; }
 
+  // returns 1 if slabs are sized by atom density in each dimension
+  inline int adaptive_a(void) const { return aAdaptive; }
+  inline int adaptive_b(void) const { return bAdaptive; }
+  inline int adaptive_c(void) const { return cAdaptive; }
+
+  // returns the width of the narrowest slab of scaled coordinate
+  inline BigReal minwidth_a(void) const { return aMinWidth; }
+  inline BigReal minwidth_b(void) const { return bMinWidth; }
+  inline BigReal minwidth_c(void) const { return cMinWidth; }
+
   // returns the origin (minimum, not center) of patch grid
   inline ScaledPosition origin(void) const {
     return ScaledPosition(aOrigin,bOrigin,cOrigin);
@@ -202,9 +219,19 @@ private:
   int aDim, bDim, cDim;
   int aAway, bAway, cAway;
   int aPeriodic, bPeriodic, cPeriodic;
+  int aAdaptive, bAdaptive, cAdaptive;
   int aMaxIndex, bMaxIndex, cMaxIndex;
   BigReal aOrigin, bOrigin, cOrigin;
   BigReal aLength, bLength, cLength;
+  BigReal aMinWidth, bMinWidth, cMinWidth;
+
+  int nProfileBins;
+  const int *atomProfile_a;
+  const int *atomProfile_b;
+  const int *atomProfile_c;
+
+  // slab of a periodic dimension sized by atom density
+  inline static int adaptiveIndex(BigReal s, const BigReal *bounds, int dim);
 
 private:
   //It is used to store the atom ids that each patch has
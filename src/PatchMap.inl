@@ -18,9 +18,26 @@ inline PatchID PatchMap::assignToPatch(Position p, const Lattice &l)
   ai = (int)floor(((BigReal)aDim)*((s.x-aOrigin)/aLength));
   bi = (int)floor(((BigReal)bDim)*((s.y-bOrigin)/bLength));
   ci = (int)floor(((BigReal)cDim)*((s.z-cOrigin)/cLength));
+  if ( aAdaptive ) ai = adaptiveIndex(s.x,patchBounds_a,aDim);
+  if ( bAdaptive ) bi = adaptiveIndex(s.y,patchBounds_b,bDim);
+  if ( cAdaptive ) ci = adaptiveIndex(s.z,patchBounds_c,cDim);
   return pid(ai,bi,ci);
 }
 
+//----------------------------------------------------------------------
+inline int PatchMap::adaptiveIndex(BigReal s, const BigReal *bounds, int dim)
+{
+  s -= floor(s + 0.5);  // periodic image in [-0.5,0.5)
+  int lo = 0;
+  int hi = dim;
+  while ( hi - lo > 1 ) {
+    int mid = ( lo + hi ) / 2;
+    if ( s < bounds[2*mid] ) hi = mid;
+    else lo = mid;
+  }
+  return lo;
+}
+
 //----------------------------------------------------------------------
 #define MODULO(I,J) ( (I)<0 ? ((J)-(-1*(I))%(J))%(J) : (I)%(J) )
 
@@ -0,0 +1,103 @@
+/**
+***  Copyright (c) 1995, 1996, 1997, 1998, 1999, 2000 by
+***  The Board of Trustees of the University of Illinois.
+***  All rights reserved.
+**/
+
+#ifndef PERFCOUNTERS_H
+#define PERFCOUNTERS_H
+
+#include <stdio.h>
+#include "converse.h"
+#include "ProcessorPrivate.h"
+
+// PerfCounters
+// Per-PE wall time accumulated by activity while outputPerfCounters is
+// set.  Time is charged exclusively: a scope nested inside another (a
+// compute run directly from a proxy message, for example) is subtracted
+// from the enclosing one.  Every outputPerfCounters steps the Controller
+// has each PE contribute its counters since the previous collection to a
+// reduction, and PE 0 writes the per-step average and maximum over PEs.
+// When disabled the only cost is a test of enabled at each scope.
+
+enum PerfCounterType {
+  PERF_COUNTER_NONBONDED,
+  PERF_COUNTER_PME,
+  PERF_COUNTER_BONDED,
+  PERF_COUNTER_OTHER_COMPUTE,
+  PERF_COUNTER_INTEGRATION,
+  PERF_COUNTER_COMMUNICATION,
+  PERF_COUNTER_MAX
+};
+
+// reduction data: step, wall time, then the counters
+#define PERF_COUNTER_DATA_SIZE (PERF_COUNTER_MAX+2)
+
+class PerfCounters {
+
+public:
+  PerfCounters();
+  ~PerfCounters();
+
+  static PerfCounters *Object() { return CkpvAccess(PerfCounters_instance); }
+
+  void enable();
+
+  // start charging time to counter, returning the counter it interrupts
+  int begin(int counter) {
+    double now = CmiWallTimer();
+    int outer = current;
+    if ( current >= 0 ) time[current] += now - mark;
+    current = counter;
+    mark = now;
+    return outer;
+  }
+
+  // stop charging the current counter and resume charging outer
+  void end(int outer) {
+    double now = CmiWallTimer();
+    if ( current >= 0 ) time[current] += now - mark;
+    current = outer;
+    mark = now;
+  }
+
+  // fill data with the counters since the previous call on this PE
+  void collect(int step, double *data);
+
+  // on PE 0: write one record from the reduced sum and maximum
+  void report(const double *sum, const double *max);
+
+  int enabled;
+
+private:
+  double time[PERF_COUNTER_MAX];
+  double collected[PERF_COUNTER_MAX];
+  double collectTime;
+  double mark;
+  int current;
+
+  // PE 0 only
+  FILE *file;
+  int lastStep;
+};
+
+// Charges the time until it goes out of scope to one counter.
+class PerfCounterScope {
+
+public:
+  PerfCounterScope(int counter) : pc(PerfCounters::Object()) {
+    active = pc->enabled;
+    if ( active ) outer = pc->begin(counter);
+  }
+  ~PerfCounterScope() {
+    if ( active ) pc->end(outer);
+  }
+
+private:
+  PerfCounters *pc;
+  int active;
+  int outer;
+};
+
+#endif
+
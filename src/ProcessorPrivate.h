@@ -19,6 +19,7 @@ class LdbCoordinator;
 class Node;
 class PatchMap;
 class PatchMgr;
+class PerfCounters;
 class ProxyMgr;
 class ReductionMgr;
 class Communicate;
@@ -38,6 +39,7 @@ CkpvExtern(LdbCoordinator*, LdbCoordinator_instance);
 CkpvExtern(Node*, Node_instance);
 CkpvExtern(PatchMap*, PatchMap_instance);
 CkpvExtern(PatchMgr*, PatchMgr_instance);
+CkpvExtern(PerfCounters*, PerfCounters_instance);
 CkpvExtern(ProxyMgr*, ProxyMgr_instance);
 CkpvExtern(ReductionMgr*, ReductionMgr_instance);
 CkpvExtern(Sync*, Sync_instance);
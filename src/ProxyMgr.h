@@ -22,10 +22,8 @@
 extern int proxySendSpanning, proxyRecvSpanning;
 extern int proxySpanDim;
 extern int inNodeProxySpanDim;
-
-#if CMK_PERSISTENT_COMM
-#define USE_PERSISTENT_TREE                  0
-#endif
+extern int proxyPersistent;
+extern int proxyNodeCombine;
 
 class ProxyGBISP1ResultMsg: public CMessage_ProxyGBISP1ResultMsg {
   public:
@@ -122,6 +120,24 @@ public:
   CompAtomExt *positionExtList;
   CudaAtom *cudaAtomList;
 
+  //With proxyPositionPrecision set, positions on steps without
+  //migration are sent as fixed-point offsets from the corner of
+  //their bounding box, in 16 or 21 bits per coordinate, instead of
+  //in positionList.  The proxy keeps the rest of each CompAtom from
+  //the last migration step.
+  int quantBits;  // 0 if positions are in positionList
+  Vector quantOrigin;
+  Vector quantStep;
+  char *quantPositionList;
+
+  //Returns the fewest bits per coordinate, 16 or 21, that represent
+  //the positions to within precision, or 0 if neither does.
+  static int quantizeBits(const CompAtom *a, int n, BigReal precision,
+                          Vector &origin, Vector &step);
+  static int quantLen(int bits, int n) { return ( bits == 16 ? 6 : 8 ) * n; }
+  void packPositions(const CompAtom *a, int n);
+  void unpackPositions(CompAtom *a) const;
+
 #if defined(NODEAWARE_PROXY_SPANNINGTREE) && defined(USE_NODEPATCHMGR) && (CMK_SMP) && defined(NAMDSRC_IMMQD_HACK)
   //In smp layer, the couter for msg creation and process of communication
   //thread is not included in the quiescence detection process. In addition,
@@ -340,6 +356,9 @@ public:
 
   void setProxyTreeBranchFactor(int dim);
 
+  void setPersistentComm();
+  void setNodeCombine();
+
   void buildProxySpanningTree();
   void sendSpanningTrees();
   void sendSpanningTreeToHomePatch(int pid, int *tree, int n);
@@ -372,6 +391,7 @@ public:
   void sendResults(ProxyResultMsg *);
   void recvResults(ProxyResultMsg *);
   void sendResults(ProxyCombinedResultMsg *);
+  void sendResultsOnNode(ProxyCombinedResultMsg *);
 
   void sendResult(ProxyGBISP1ResultMsg *);//psiSum
   void recvResult(ProxyGBISP1ResultMsg *);
@@ -446,6 +466,15 @@ private:
 	CmiNodeLock localDepositLock;
 	CmiNodeLock remoteDepositLock;
 
+/* The following vars are for combining the results of all proxies of a
+   patch on this node into one message to the home patch */
+	int numResultPatches;
+	int *nodeResultProxies; //registered proxies of each patch on this node
+	int *nodeResultWait; //proxies whose results have been deposited
+	ProxyCombinedResultMsg **nodeResultBuffer;
+	CmiNodeLock *nodeResultLocks;
+	CmiNodeLock nodeResultTableLock;
+
 public:
     NodeProxyMgr(){
         proxyInfo = NULL;
@@ -461,6 +490,13 @@ public:
 		remoteProxyLists = NULL;
 		localDepositLock = CmiCreateLock();
 		remoteDepositLock = CmiCreateLock();
+
+		numResultPatches = 0;
+		nodeResultProxies = NULL;
+		nodeResultWait = NULL;
+		nodeResultBuffer = NULL;
+		nodeResultLocks = NULL;
+		nodeResultTableLock = CmiCreateLock();
     }
     ~NodeProxyMgr(){
         for(int i=0; i<numPatches; i++) {
@@ -471,6 +507,16 @@ public:
 
 		CmiDestroyLock(localDepositLock);
 		CmiDestroyLock(remoteDepositLock);
+
+		for(int i=0; i<numResultPatches; i++) {
+			delete nodeResultBuffer[i];
+			CmiDestroyLock(nodeResultLocks[i]);
+		}
+		delete [] nodeResultProxies;
+		delete [] nodeResultWait;
+		delete [] nodeResultBuffer;
+		delete [] nodeResultLocks;
+		CmiDestroyLock(nodeResultTableLock);
     }
 
     void createProxyInfo(int numPs){
@@ -507,6 +553,10 @@ public:
 	//remote call to send this node's proxy list info
 	void sendProxyListInfo(PatchProxyListMsg *msg);
 	void contributeToParent();
+
+	//direct calls from local proxies when combining results on the node
+	void registerResultProxy(PatchID pid, int count);
+	ProxyCombinedResultMsg *depositResults(ProxyCombinedResultMsg *msg);
 };
 
 #endif /* PATCHMGR_H */
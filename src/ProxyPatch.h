@@ -46,11 +46,21 @@ class ProxyPatch : public Patch
 
 #if CMK_PERSISTENT_COMM
   private:
-     PersistentHandle localphs;
+     // channels to the home patch and to the spanning tree children,
+     // created or enlarged to fit the messages sent on them
+     PersistentHandle  localphs;
+     int               resultPersistSize;
      PersistentHandle *treephs;
      int               ntreephs;
+     int               treePersistSize;
+     void buildSpanningTreePhs(int msgSize);
+     void destroySpanningTreePhs();
   public:
-     PersistentHandle *getSpanningTreePhs(int &n) { n = ntreephs; return treephs; }
+     // NULL unless channels to all children fit a message of msgSize
+     PersistentHandle *getSpanningTreePhs(int &n, int msgSize) {
+       n = ntreephs;
+       return ( msgSize <= treePersistSize ) ? treephs : NULL;
+     }
 #endif
   protected:
 
@@ -185,6 +185,13 @@ enum {
 // Later this can be dynamic
 #define REDUCTION_MAX_CHILDREN 4
 
+// In SMP builds, children on the same node add their data directly into
+// the parent's queue instead of sending a message, so only the first PE
+// of each node sends a message into the inter-node tree.
+#ifndef REDUCTION_NODE_COMBINE
+#define REDUCTION_NODE_COMBINE CMK_SMP
+#endif
+
 class ReductionRegisterMsg;
 class ReductionSubmitMsg;
 class SubmitReduction;
@@ -196,16 +203,19 @@ public:
   int sequenceNumber;
   int submitsRecorded;
   BigReal *data;
+  BigReal *nodeData;  // contributions from same-node children
   ReductionSetData *next;
   ReductionSetData(int seqNum, int size) {
     sequenceNumber = seqNum;
     submitsRecorded = 0;
     data = new BigReal[size];
     for ( int i = 0; i < size; ++i ) { data[i] = 0; }
+    nodeData = 0;
     next = 0;
   }
   ~ReductionSetData() {
     delete [] data;
+    delete [] nodeData;
   }
 };
 
@@ -261,6 +271,14 @@ private:
   }
   int isRoot(void) const { return ( myParent == -1 ); }
 
+  int myPe;  // may run on a child's thread when combining within a node
+#if REDUCTION_NODE_COMBINE
+  CmiNodeLock lock;  // protects reductionSets from same-node children
+  int nodeParentRank;  // rank of parent if on this node and not root
+  void nodeSubmit(int setID, int sourcePe, int seqNum,
+                  const BigReal *newData, int size);
+#endif
+
   ReductionSet* getSet(int setID, int size);
   void delSet(int setID);
 
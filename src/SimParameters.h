@@ -66,6 +66,8 @@ typedef int  MTSChoices;
 #define LDBSTRAT_COMPREHENSIVE	11
 #define LDBSTRAT_REFINEONLY	12
 #define LDBSTRAT_OLD		13
+#define LDBSTRAT_GRAPH		14
+#define LDBSTRAT_DIFFUSION	15
 
 // The following definitions are used to distinguish between patch-splitting
 // strategies
@@ -136,6 +138,9 @@ public:
 	BigReal ldbPMEBackgroundScaling;//  scaling factor for PME background
 	BigReal ldbHomeBackgroundScaling;//  scaling factor for home background
 	BigReal ldbRelativeGrainsize;   //  fraction of average load per compute
+	int ldbDiffusionMoves;		//  computes each pe may move per
+					//  diffusion load balancing step
+	char ldbDumpFile[128];		//  prefix for load balancer data files
 	
 	int traceStartStep; //the timestep when trace is turned on, default to 3*firstLdbStep;
 	int numTraceSteps; //the number of timesteps that are traced, default to 2*ldbPeriod;
@@ -152,6 +157,7 @@ public:
 	int simulatedNodeSize;
 	Bool disableTopology; // ignore torus information during patch placement
 	Bool verboseTopology; // print torus information during patch placement
+	Bool initialCostModel; // place patches and computes by estimated cost
 
 	Bool benchTimestep; //only cares about benchmarking the timestep, so no file output to save SUs for large-scale benchmarking
 
@@ -165,6 +171,7 @@ public:
 	int twoAwayY;			//  half-size patches in Y dimension
 	int twoAwayZ;			//  half-size patches in Z dimension
 	int maxPatches;			//  maximum patch count
+	Bool adaptivePatchGrid;		//  size patches by atom density
 	Bool ldbUnloadPME;		//  unload processors doing PME
 	Bool ldbUnloadZero;		//  unload processor 0
 	Bool ldbUnloadOne;		//  unload processor 1 
@@ -191,6 +198,11 @@ public:
 	int dcdFrequency;		//  How often (in timesteps) should
 					//  a DCD trajectory file be updated
   int dcdUnitCell;  // Whether to write unit cell information in the DCD
+	int compressedDcdFrequency;	//  How often (in timesteps) should
+					//  a compressed trajectory be updated
+	BigReal compressedDcdPrecision;	//  Inverse of coordinate resolution
+	Bool dcdSelectionOn;		//  Flag TRUE-> trajectories only
+					//  contain selected atoms
 	int velDcdFrequency;		//  How often (in timesteps) should
 					//  a velocity DCD file be updated
 	int forceDcdFrequency;		//  How often (in timesteps) should
@@ -199,6 +211,7 @@ public:
 					//  a XST trajectory file be updated
 	char auxFilename[128];		//  auxilary output filename
 	char dcdFilename[128];		//  DCD filename
+	char compressedDcdFilename[128];	//  Compressed trajectory filename
 	char velDcdFilename[128];       //  Velocity DCD filename
 	char forceDcdFilename[128];     //  Force DCD filename
 	char xstFilename[128];		//  Extended system trajectory filename
@@ -216,6 +229,9 @@ public:
 					//  binary format rather than PDB
 	Bool binaryOutput;		//  should output files be
 					//  binary format rather than PDB
+	Bool asyncOutput;		//  write trajectory and restart
+					//  files on a background thread
+	char startupProfileFile[128];	//  JSON report of startup phases
 	BigReal cutoff;			//  Cutoff distance
 	BigReal margin;			//  Fudge factor on patch size
 	BigReal patchDimension;		//  Dimension of each side of a patch
@@ -629,6 +645,7 @@ public:
 
 	Bool langevinPistonOn;		//  Langevin piston pressure control
 	Bool langevinPistonBarrier;	//  Turn off to extrapolate cell
+	Bool controllerBarrier;		//  Turn off to let coupling lag one step
 	BigReal langevinPistonTarget;
 	BigReal langevinPistonPeriod;
 	BigReal langevinPistonDecay;
@@ -816,9 +833,19 @@ public:
 	int outputCudaTiming;		//  Number of timesteps between timing
 					//  outputs of CUDA code
 
+	int outputPerfCounters;		//  Number of timesteps between
+					//  performance counter outputs
+	char perfCountersFilename[128];	//  Performance counter output file
+	Bool perfCountersJSON;		//  JSON lines rather than CSV
+
 	int outputPressure;		//  Number of timesteps between pressure
 					//  tensor outputs
 
+	Bool lazyReductions;		//  Only reduce kinetic energy and virial
+					//  on steps that consume them
+	Bool doVirialOnStep(const int); //  Are kinetic energy and virial
+					//  needed on this step?
+
 	Bool mergeCrossterms;		//  Merge crossterm energy w/ dihedrals
 
 	int firstTimestep;		//  Starting timestep.  Will be 0 unless
@@ -848,6 +875,10 @@ public:
 
 	Bool useSettle;			// Use SETTLE; requires rigid waters
 
+	Bool hmrOn;			// Repartition hydrogen masses
+	BigReal hmrMass;		// Mass of repartitioned hydrogens
+	Bool autoTimestep;		// Reduce dt to estimated stable value
+
 	Bool testOn;			//  Do tests rather than simulation
 	Bool commOnly;			//  Don't do any force evaluations
 	Bool statsOn;			//  Don't do any force evaluations
@@ -933,6 +964,7 @@ public:
 
 	Bool useCompressedPsf;
 	Bool genCompressedPsf;
+	Bool binaryCompressedPsf;	//  Write the compressed psf in binary form
 
 	Bool usePluginIO;
 
@@ -945,6 +977,11 @@ public:
 
     int proxyTreeBranchFactor;
 
+	BigReal proxyPositionPrecision;	//  max error of quantized proxy positions
+	Bool proxyPersistentComm;	//  reuse persistent channels for proxy messages
+	Bool proxyCombineResultsOnNode;	//  one result message per node and patch
+	Bool offNodeProxyPriority;	//  only off-node proxies get compute priority
+
 
     //fields needed for Parallel IO Input
     int numinputprocs;
@@ -956,6 +993,8 @@ public:
     //fields needed for Parallel IO Output
     int numoutputprocs; 
     int numoutputwrts;
+    Bool outputAggregation;	//  numoutputwrts procs gather DCD frames
+    int outputStripeSize;	//  alignment of aggregated writes in bytes
 
 	char computeMapFilename[128];		//  store compute map
         Bool storeComputeMap;
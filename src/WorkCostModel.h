@@ -0,0 +1,71 @@
+/**
+***  Copyright (c) 1995, 1996, 1997, 1998, 1999, 2000 by
+***  The Board of Trustees of the University of Illinois.
+***  All rights reserved.
+**/
+
+#ifndef WORKCOSTMODEL_H
+#define WORKCOSTMODEL_H
+
+#include <map>
+#include "ResizeArray.h"
+
+// WorkCostModel
+// Estimates the nonbonded work of patches and pair computes before any
+// load has been measured, so that the initial mapping is balanced by
+// expected work rather than by atom count.  A self or pair compute is
+// charged for the atom pairs expected within the cutoff, from the atom
+// counts and the overlap of the patch volumes, and for the excluded
+// pairs of its atoms; alchemical atoms and GBIS scale this up.  Each
+// atom is also charged for integration.  The costs per pair and per atom
+// are measured by a short benchmark when the model is created on the PE
+// doing the mapping, after patches have been filled with atoms.
+
+class WorkCostModel {
+
+public:
+  WorkCostModel();
+
+  // seconds per step of one compute
+  double selfCost(int pid);
+  double pairCost(int p1, int p2, int trans);
+
+  // seconds per step of the atoms of a patch
+  double atomCost(int pid) const;
+
+  // per patch: atoms, self compute, and half of each pair compute,
+  // in units of the cost of integrating one atom
+  void patchCosts(double *costs);
+
+  // choose the PE of each nonbonded pair compute, in the order of
+  // PatchMap::oneOrTwoAwayNeighbors, from the home and base PEs of its
+  // patches, placing the most costly first on the least loaded PE
+  void placePairComputes(int numPes, ResizeArray<int> &pairPes);
+
+private:
+  void calibrate();
+  int numAtoms(int pid) const;
+  double pairFraction(int p1, int p2, int trans);
+  double alchScaling(int p1, int p2) const;
+
+  double secondsPerPair;
+  double secondsPerAtom;
+  double pairScaling;  // GBIS and alchemical kernels
+  double exclusionsPerAtom;
+  double cutoff2;
+  ResizeArray<double> alchFraction;  // per patch
+
+  struct OverlapKey {
+    double d[9];  // extents of both patches and offset between them
+    bool operator<(const OverlapKey &k) const {
+      for ( int i = 0; i < 9; ++i ) {
+        if ( d[i] != k.d[i] ) return d[i] < k.d[i];
+      }
+      return false;
+    }
+  };
+  std::map<OverlapKey,double> overlapCache;
+};
+
+#endif
+
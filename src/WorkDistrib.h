@@ -19,6 +19,7 @@
 class Node;
 class Compute;
 class Molecule;
+class WorkCostModel;
 
 // For Compute objects to enqueue themselves when ready to compute
 class LocalWorkMsg : public CMessage_LocalWorkMsg
@@ -119,6 +120,13 @@ public:
   static int *peCompactOrdering;       // pes in compact order
   static int *peCompactOrderingIndex;  // index of pe in compact order
 
+  // From +switchmap or +nodesperswitch, physical nodes on the same network
+  // switch are contiguous in the compact order; without either each
+  // physical node is its own switch and numSwitches is zero.
+  static int numSwitches;
+  static int *peSwitch;                // switch of pe, in compact order
+  static void getPesOnSwitch(int sw, int **pes, int *npes);
+
   struct pe_sortop_diffuse {
     inline bool operator() (int a, int b) const {
       const int *index = WorkDistrib::peDiffuseOrderingIndex;
@@ -171,6 +179,9 @@ private:
   bool patchMapArrived;
   bool computeMapArrived;
 
+  // PE 0 only, from assignNodeToPatch() through mapComputes()
+  WorkCostModel *costModel;
+
   int saveComputeMapReturnEP;
   CkGroupID saveComputeMapReturnChareID;
 };
@@ -62,6 +62,9 @@ int open_dcd_write(const char *);     /*  Open a DCD file for writing		*/
 
 int write_dcdstep(int, int, float *, float *, float *, double *unitcell);
 				/*  Write out a timesteps values	*/
+int write_dcdstep_noabort(int, int, const float *, const float *,
+                          const float *, const double *unitcell);
+				/*  Same, returns -1 and errno on failure */
 int write_dcdheader(int, const char*, int, int, int, int, int, double, int);	
 				/*  Write a dcd header			*/
 int get_dcdheader_size(); 
@@ -81,6 +84,20 @@ int update_dcdstep_par_header(int fd);
 /* Write out a timesteps values partially in parallel for part [parL, parU] */
 int write_dcdstep_par_slave(int fd, int parL, int parU, int N, float *X, float *Y, float *Z);
     
+int write_cdcdheader(int, int, int, int, double, float);
+				/*  Write a compressed trajectory header */
+int write_cdcdstep(int, int, int, float *, float *, float *, double *, float);
+				/*  Write a compressed timestep, returns */
+				/*  bytes written			*/
+int get_cdcdstep_maxsize(int);
+int pack_cdcdstep(int, const float *, const float *, const float *, float,
+		  unsigned char *);
+				/*  Pack coordinates into buffer	*/
+int get_cdcdframe_maxsize(int);
+int pack_cdcdframe(int, int, const float *, const float *, const float *,
+		   const double *, float, unsigned char *);
+				/*  Pack a whole timestep into buffer	*/
+
 /* wrapper for seeking the dcd file */
 OFF_T NAMD_seek(int file, OFF_T offset, int whence);
 